@@ -18,8 +18,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <optional>
 #include <vector>
 
@@ -106,6 +108,59 @@ class BitVector {
     size_ = 0;
   }
 
+  // Padding bits past size() are ignored, so vectors that hold the same bits
+  // hash equally regardless of how they were built.
+  std::size_t Hash() const noexcept {
+    auto full = size_ / kWordBits;
+    auto hash = Mix(size_);
+    for (size_type i = 0; i != full; ++i) hash = Mix(hash ^ words_[i]);
+    if (full != words_.size()) hash = Mix(hash ^ TailWord(full, size_));
+    return Finalize(hash);
+  }
+
+  friend bool operator==(const BitVector& lhs, const BitVector& rhs) noexcept {
+    if (lhs.size_ != rhs.size_) return false;
+    auto full = lhs.size_ / kWordBits;
+    if (!std::equal(lhs.words_.data(), lhs.words_.data() + full,
+                    rhs.words_.data()))
+      return false;
+    return full == lhs.words_.size() ||
+           lhs.TailWord(full, lhs.size_) == rhs.TailWord(full, rhs.size_);
+  }
+
+  friend bool operator!=(const BitVector& lhs, const BitVector& rhs) noexcept {
+    return !(lhs == rhs);
+  }
+
+  // Lexicographic order over the bits from the left. Words store the leftmost
+  // bit in their most significant position, so comparing them as unsigned
+  // integers orders them lexicographically as well.
+  friend bool operator<(const BitVector& lhs, const BitVector& rhs) noexcept {
+    auto common = std::min(lhs.size_, rhs.size_);
+    auto full = common / kWordBits;
+    auto [lhs_iter, rhs_iter] = std::mismatch(
+        lhs.words_.data(), lhs.words_.data() + full, rhs.words_.data());
+    if (lhs_iter != lhs.words_.data() + full) return *lhs_iter < *rhs_iter;
+    if (common % kWordBits != 0) {
+      auto lhs_tail = lhs.TailWord(full, common);
+      auto rhs_tail = rhs.TailWord(full, common);
+      if (lhs_tail != rhs_tail) return lhs_tail < rhs_tail;
+    }
+    return lhs.size_ < rhs.size_;
+  }
+
+  friend bool operator>(const BitVector& lhs, const BitVector& rhs) noexcept {
+    return rhs < lhs;
+  }
+
+  friend bool operator<=(const BitVector& lhs, const BitVector& rhs) noexcept {
+    return !(rhs < lhs);
+  }
+
+  friend bool operator>=(const BitVector& lhs, const BitVector& rhs) noexcept {
+    return !(lhs < rhs);
+  }
+
   class reference {
    public:
     operator bool() const noexcept { return vec_.test<From::Left>(pos_); }
@@ -146,6 +201,41 @@ class BitVector {
     return Cursor{word_cursor, bit_cursor};
   }
 
+  // Returns words_[word] with the bits at and past bit count cleared. Requires
+  // count to end inside words_[word].
+  size_type TailWord(size_type word, size_type count) const noexcept {
+    auto used = count - kWordBits * word;
+    return words_[word] & (~size_type(0) << (kWordBits - used));
+  }
+
+  static constexpr size_type Mix(size_type x) noexcept {
+    if constexpr (kWordBits == 64) {
+      x *= 0x9E3779B97F4A7C15;
+      return x ^ (x >> 32);
+    } else {
+      x *= 0x9E3779B9;
+      return x ^ (x >> 16);
+    }
+  }
+
+  // A multiply only carries changes upwards, so avalanche the folded words
+  // into the low bits that hash tables use to pick a bucket.
+  static constexpr size_type Finalize(size_type x) noexcept {
+    if constexpr (kWordBits == 64) {
+      x ^= x >> 33;
+      x *= 0xFF51AFD7ED558CCD;
+      x ^= x >> 33;
+      x *= 0xC4CEB9FE1A85EC53;
+      return x ^ (x >> 33);
+    } else {
+      x ^= x >> 16;
+      x *= 0x85EBCA6B;
+      x ^= x >> 13;
+      x *= 0xC2B2AE35;
+      return x ^ (x >> 16);
+    }
+  }
+
   void FixGrowthBorder(size_type old_size, bool value) noexcept {
     auto end_mask = ~size_type(0);
     end_mask >>= (old_size % kWordBits);
@@ -160,3 +250,14 @@ class BitVector {
 };
 
 }  // namespace bpp
+
+namespace std {
+
+template <>
+struct hash<bpp::BitVector> {
+  std::size_t operator()(const bpp::BitVector& vec) const noexcept {
+    return vec.Hash();
+  }
+};
+
+}  // namespace std
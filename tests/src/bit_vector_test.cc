@@ -19,7 +19,9 @@
 #include "bitplusplus/bit_vector.h"
 
 #include <cstddef>
+#include <functional>
 #include <tuple>
+#include <unordered_set>
 
 #include "gtest/gtest.h"
 
@@ -78,4 +80,63 @@ TEST(BitVectorTest, Reference) {
   EXPECT_EQ(vec.CountZero<From::Right>(), 1);
 }
 
+TEST(BitVectorTest, EqualIgnoresPadding) {
+  auto lhs = BitVector(120, true);
+  lhs.resize(70);
+  auto rhs = BitVector(70, false);
+  for (std::size_t i = 0; i != 70; ++i) rhs[i] = true;
+  EXPECT_EQ(lhs, rhs);
+  EXPECT_EQ(std::hash<BitVector>{}(lhs), std::hash<BitVector>{}(rhs));
+  rhs[69] = false;
+  EXPECT_NE(lhs, rhs);
+  EXPECT_NE(BitVector(64, false), BitVector(65, false));
+}
+
+TEST(BitVectorTest, Compare) {
+  auto lhs = BitVector(100, false);
+  auto rhs = BitVector(100, false);
+  lhs.set<From::Left>(80);
+  rhs.set<From::Left>(79);
+  EXPECT_LT(lhs, rhs);
+  EXPECT_GT(rhs, lhs);
+  lhs.set<From::Left>(3);
+  EXPECT_LT(rhs, lhs);
+
+  auto prefix = BitVector(120, true);
+  prefix.resize(70);
+  auto longer = BitVector(71, true);
+  EXPECT_LT(prefix, longer);
+  EXPECT_LE(prefix, longer);
+  EXPECT_GE(prefix, prefix);
+  longer.reset<From::Left>(69);
+  EXPECT_LT(longer, prefix);
+}
+
+TEST(BitVectorTest, HashSet) {
+  auto set = std::unordered_set<BitVector>{};
+  for (std::size_t i = 0; i != 200; ++i) {
+    auto vec = BitVector(200, false);
+    vec[i] = true;
+    set.insert(vec);
+  }
+  EXPECT_EQ(set.size(), 200);
+  auto vec = BitVector(300, true);
+  vec.resize(200);
+  for (std::size_t i = 0; i != 200; ++i) vec[i] = i == 42;
+  EXPECT_EQ(set.count(vec), 1);
+}
+
+TEST(BitVectorTest, HashSpreadsLowBits) {
+  for (std::size_t size : {64, 128, 100}) {
+    auto low_bits = std::unordered_set<std::size_t>{};
+    auto tail = (size - 1) / BitVector::kWordBits * BitVector::kWordBits;
+    for (std::size_t pattern = 0; pattern != 256; ++pattern) {
+      auto vec = BitVector(size, false);
+      for (std::size_t i = 0; i != 8; ++i) vec[tail + i] = pattern >> i & 1;
+      low_bits.insert(std::hash<BitVector>{}(vec) & 0xFFFF);
+    }
+    EXPECT_GT(low_bits.size(), 250);
+  }
+}
+
 }  // namespace bpp